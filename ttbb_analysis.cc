@@ -262,6 +262,14 @@ namespace Rivet {
 
       book(_h["fid_xsec_geq1lep"],                 "fid_xsec_geq1lep"                    , fid_xsec_bins);
 
+      // resolve the fill handles once, so analyze() needs no map lookups
+      _h_3b_geq5j_ljets    = categoryHistos("3b_geq5j_ljets");
+      _h_geq4b_geq5j_ljets = categoryHistos("geq4b_geq5j_ljets");
+      _h_geq4b_geq6j_ljets = categoryHistos("geq4b_geq6j_ljets");
+      _h_3b_geq4j_dil      = categoryHistos("3b_geq4j_dil");
+      _h_geq4b_geq4j_dil   = categoryHistos("geq4b_geq4j_dil");
+      _h_fid_xsec_geq1lep  = _h.at("fid_xsec_geq1lep");
+
       // (abs) weight histos
       // book(_h["abs_weight_1000_3b_geq5j_ljets"],    "abs_weight_1000_3b_geq5j_ljets",    1400, 0.0, 1400.0);
       // book(_h["abs_weight_1000_geq4b_geq5j_ljets"], "abs_weight_1000_geq4b_geq5j_ljets", 1400, 0.0, 1400.0);
@@ -329,7 +337,7 @@ namespace Rivet {
       bool pass_dil   = (leptons.size() == 2 && leptons[0].pT() > 27*GeV && leptons[1].pT() > 27*GeV);
 
       if (!(pass_ljets || pass_dil)) vetoEvent;
-      _h["fid_xsec_geq1lep"] -> fill(event.weights()[0]);
+      _h_fid_xsec_geq1lep -> fill(event.weights()[0]);
       if (nbjets < 3 || njets < 4)  vetoEvent;
      
       // fill histogram with leading b-jet pT
@@ -388,44 +396,44 @@ namespace Rivet {
 
       // lets do the 3bjets geq5njets category first
       if (pass_ljets && (nbjets == 3 && njets >= 5)) {
-          _h["N_Jets_3b_geq5j_ljets"]               -> fill(njets);
-          _h["N_b_Jets_3b_geq5j_ljets"]             -> fill(nbjets);
+          _h_3b_geq5j_ljets.N_Jets                  -> fill(njets);
+          _h_3b_geq5j_ljets.N_b_Jets                -> fill(nbjets);
           for (size_t i = 0; i < bjets.size(); ++i) {
-              _h["all_bjets_pt_3b_geq5j_ljets"]     -> fill(bjets[i].pT()/GeV);
+              _h_3b_geq5j_ljets.all_bjets_pt        -> fill(bjets[i].pT()/GeV);
           }
           for (size_t i = 0; i < lfjets.size(); ++i) {
-              _h["all_lfjets_pt_3b_geq5j_ljets"]    -> fill(lfjets[i].pT()/GeV);
+              _h_3b_geq5j_ljets.all_lfjets_pt       -> fill(lfjets[i].pT()/GeV);
           }
-          _h["ht_bjets_3b_geq5j_ljets"]             -> fill(ht_bjets/GeV);
-          _h["ht_lfjets_3b_geq5j_ljets"]            -> fill(ht_lfjets/GeV);
+          _h_3b_geq5j_ljets.ht_bjets                -> fill(ht_bjets/GeV);
+          _h_3b_geq5j_ljets.ht_lfjets               -> fill(ht_lfjets/GeV);
           // b-jet pTs
-          _h["lead_bjet_pt_3b_geq5j_ljets"]         -> fill(bjets[0].pT()/GeV);
-          _h["sublead_bjet_pt_3b_geq5j_ljets"]      -> fill(bjets[1].pT()/GeV);
-          _h["third_bjet_pt_3b_geq5j_ljets"]        -> fill(bjets[2].pT()/GeV);
+          _h_3b_geq5j_ljets.lead_bjet_pt            -> fill(bjets[0].pT()/GeV);
+          _h_3b_geq5j_ljets.sublead_bjet_pt         -> fill(bjets[1].pT()/GeV);
+          _h_3b_geq5j_ljets.third_bjet_pt           -> fill(bjets[2].pT()/GeV);
 
           // HT
-          _h["ht_3b_geq5j_ljets"]                   -> fill(ht/GeV);
-          _h["ht_had_3b_geq5j_ljets"]               -> fill(hthad/GeV);
+          _h_3b_geq5j_ljets.ht                      -> fill(ht/GeV);
+          _h_3b_geq5j_ljets.ht_had                  -> fill(hthad/GeV);
 
           // leading bb pair
-          _h["m_bb_leading_3b_geq5j_ljets"]         -> fill(jsum.mass()/GeV);
-          _h["pt_bb_leading_3b_geq5j_ljets"]        -> fill(jsum.pT()/GeV);
-          _h["dR_bb_leading_3b_geq5j_ljets"]        -> fill(dr_leading);
+          _h_3b_geq5j_ljets.m_bb_leading            -> fill(jsum.mass()/GeV);
+          _h_3b_geq5j_ljets.pt_bb_leading           -> fill(jsum.pT()/GeV);
+          _h_3b_geq5j_ljets.dR_bb_leading           -> fill(dr_leading);
 
           // closest bb pair
-          _h["m_bb_closest_3b_geq5j_ljets"]         -> fill(bb_closest.mass()/GeV);
-          _h["pt_bb_closest_3b_geq5j_ljets"]        -> fill(bb_closest.pT()/GeV);
-          _h["dR_bb_closest_3b_geq5j_ljets"]        -> fill(dr_closest);
+          _h_3b_geq5j_ljets.m_bb_closest            -> fill(bb_closest.mass()/GeV);
+          _h_3b_geq5j_ljets.pt_bb_closest           -> fill(bb_closest.pT()/GeV);
+          _h_3b_geq5j_ljets.dR_bb_closest           -> fill(dr_closest);
 
 	        // bb pair with highest vectorial sum pt                                            
-          _h["m_bb_leadingVec_3b_geq5j_ljets"]         -> fill(m_leading_vec/GeV);
-          _h["pt_bb_leadingVec_3b_geq5j_ljets"]        -> fill(pt_leading_vec/GeV);
-          _h["dR_bb_leadingVec_3b_geq5j_ljets"]        -> fill(dr_leading_vec);
+          _h_3b_geq5j_ljets.m_bb_leadingVec            -> fill(m_leading_vec/GeV);
+          _h_3b_geq5j_ljets.pt_bb_leadingVec           -> fill(pt_leading_vec/GeV);
+          _h_3b_geq5j_ljets.dR_bb_leadingVec           -> fill(dr_leading_vec);
 
           // average dR
-          _h["dR_bb_average_3b_geq5j_ljets"]        -> fill(sum_dr/sum_n_dr);
+          _h_3b_geq5j_ljets.dR_bb_average           -> fill(sum_dr/sum_n_dr);
 
-          _h["fid_xsec_3b_geq5j_ljets"]           -> fill(event.weights()[0]);
+          _h_3b_geq5j_ljets.fid_xsec              -> fill(event.weights()[0]);
           // _h["abs_weight_1000_3b_geq5j_ljets"] -> fill(event.weights()[0]);
           // _h["abs_weight_100_3b_geq5j_ljets"]  -> fill(event.weights()[0]);
           // _h["abs_weight_5_3b_geq5j_ljets"]    -> fill(event.weights()[0]);
@@ -434,46 +442,46 @@ namespace Rivet {
 
       // lets do the geq4bjets geq5njets category
       if (pass_ljets && (nbjets >= 4 && njets >= 5)) {
-          _h["N_Jets_geq4b_geq5j_ljets"]            -> fill(njets);
-          _h["N_b_Jets_geq4b_geq5j_ljets"]          -> fill(nbjets);
+          _h_geq4b_geq5j_ljets.N_Jets               -> fill(njets);
+          _h_geq4b_geq5j_ljets.N_b_Jets             -> fill(nbjets);
           for (size_t i = 0; i < bjets.size(); ++i) {
-              _h["all_bjets_pt_geq4b_geq5j_ljets"]  -> fill(bjets[i].pT()/GeV);
+              _h_geq4b_geq5j_ljets.all_bjets_pt     -> fill(bjets[i].pT()/GeV);
           }
           for (size_t i = 0; i < lfjets.size(); ++i) {
-              _h["all_lfjets_pt_geq4b_geq5j_ljets"] -> fill(lfjets[i].pT()/GeV);
+              _h_geq4b_geq5j_ljets.all_lfjets_pt    -> fill(lfjets[i].pT()/GeV);
           }
-          _h["ht_bjets_geq4b_geq5j_ljets"]          -> fill(ht_bjets/GeV);
-          _h["ht_lfjets_geq4b_geq5j_ljets"]         -> fill(ht_lfjets/GeV);
+          _h_geq4b_geq5j_ljets.ht_bjets             -> fill(ht_bjets/GeV);
+          _h_geq4b_geq5j_ljets.ht_lfjets            -> fill(ht_lfjets/GeV);
           // b-jet pTs
-          _h["lead_bjet_pt_geq4b_geq5j_ljets"]      -> fill(bjets[0].pT()/GeV);
-          _h["sublead_bjet_pt_geq4b_geq5j_ljets"]   -> fill(bjets[1].pT()/GeV);
-          _h["third_bjet_pt_geq4b_geq5j_ljets"]     -> fill(bjets[2].pT()/GeV);              
-          _h["fourth_bjet_pt_geq4b_geq5j_ljets"]    -> fill(bjets[3].pT()/GeV);
+          _h_geq4b_geq5j_ljets.lead_bjet_pt         -> fill(bjets[0].pT()/GeV);
+          _h_geq4b_geq5j_ljets.sublead_bjet_pt      -> fill(bjets[1].pT()/GeV);
+          _h_geq4b_geq5j_ljets.third_bjet_pt        -> fill(bjets[2].pT()/GeV);              
+          _h_geq4b_geq5j_ljets.fourth_bjet_pt       -> fill(bjets[3].pT()/GeV);
 
           // HT
-          _h["ht_geq4b_geq5j_ljets"]                -> fill(ht/GeV);
-          _h["ht_had_geq4b_geq5j_ljets"]            -> fill(hthad/GeV);
+          _h_geq4b_geq5j_ljets.ht                   -> fill(ht/GeV);
+          _h_geq4b_geq5j_ljets.ht_had               -> fill(hthad/GeV);
 
           // leading bb pair
-          _h["m_bb_leading_geq4b_geq5j_ljets"]      -> fill(jsum.mass()/GeV);
-          _h["pt_bb_leading_geq4b_geq5j_ljets"]     -> fill(jsum.pT()/GeV);
-          _h["dR_bb_leading_geq4b_geq5j_ljets"]     -> fill(dr_leading);
+          _h_geq4b_geq5j_ljets.m_bb_leading         -> fill(jsum.mass()/GeV);
+          _h_geq4b_geq5j_ljets.pt_bb_leading        -> fill(jsum.pT()/GeV);
+          _h_geq4b_geq5j_ljets.dR_bb_leading        -> fill(dr_leading);
 
           // closest bb pair
-          _h["m_bb_closest_geq4b_geq5j_ljets"]      -> fill(bb_closest.mass()/GeV);
-          _h["pt_bb_closest_geq4b_geq5j_ljets"]     -> fill(bb_closest.pT()/GeV);
-          _h["dR_bb_closest_geq4b_geq5j_ljets"]     -> fill(dr_closest);
+          _h_geq4b_geq5j_ljets.m_bb_closest         -> fill(bb_closest.mass()/GeV);
+          _h_geq4b_geq5j_ljets.pt_bb_closest        -> fill(bb_closest.pT()/GeV);
+          _h_geq4b_geq5j_ljets.dR_bb_closest        -> fill(dr_closest);
 
           // bb pair with highest vectorial sum pt                                                                                                                                                        
-          _h["m_bb_leadingVec_geq4b_geq5j_ljets"]   -> fill(m_leading_vec/GeV);
-          _h["pt_bb_leadingVec_geq4b_geq5j_ljets"]  -> fill(pt_leading_vec/GeV);
-          _h["dR_bb_leadingVec_geq4b_geq5j_ljets"]  -> fill(dr_leading_vec);
+          _h_geq4b_geq5j_ljets.m_bb_leadingVec      -> fill(m_leading_vec/GeV);
+          _h_geq4b_geq5j_ljets.pt_bb_leadingVec     -> fill(pt_leading_vec/GeV);
+          _h_geq4b_geq5j_ljets.dR_bb_leadingVec     -> fill(dr_leading_vec);
 
 
           // average dR
-          _h["dR_bb_average_geq4b_geq5j_ljets"]     -> fill(sum_dr/sum_n_dr);
+          _h_geq4b_geq5j_ljets.dR_bb_average        -> fill(sum_dr/sum_n_dr);
 
-          _h["fid_xsec_geq4b_geq5j_ljets"]           -> fill(event.weights()[0]);
+          _h_geq4b_geq5j_ljets.fid_xsec              -> fill(event.weights()[0]);
           // _h["abs_weight_1000_geq4b_geq5j_ljets"] -> fill(event.weights()[0]);
           // _h["abs_weight_100_geq4b_geq5j_ljets"]  -> fill(event.weights()[0]);
           // _h["abs_weight_5_geq4b_geq5j_ljets"]    -> fill(event.weights()[0]);
@@ -482,46 +490,46 @@ namespace Rivet {
 
       // lets do the geq4bjets geq6njets category now
       if (pass_ljets && (nbjets >= 4 && njets >= 6)) {
-          _h["N_Jets_geq4b_geq6j_ljets"]            -> fill(njets);
-          _h["N_b_Jets_geq4b_geq6j_ljets"]          -> fill(nbjets);
+          _h_geq4b_geq6j_ljets.N_Jets               -> fill(njets);
+          _h_geq4b_geq6j_ljets.N_b_Jets             -> fill(nbjets);
           for (size_t i = 0; i < bjets.size(); ++i) {
-              _h["all_bjets_pt_geq4b_geq6j_ljets"]  -> fill(bjets[i].pT()/GeV);
+              _h_geq4b_geq6j_ljets.all_bjets_pt     -> fill(bjets[i].pT()/GeV);
           }
           for (size_t i = 0; i < lfjets.size(); ++i) {
-              _h["all_lfjets_pt_geq4b_geq6j_ljets"] -> fill(lfjets[i].pT()/GeV);
+              _h_geq4b_geq6j_ljets.all_lfjets_pt    -> fill(lfjets[i].pT()/GeV);
           }
-          _h["ht_bjets_geq4b_geq6j_ljets"]          -> fill(ht_bjets/GeV);
-          _h["ht_lfjets_geq4b_geq6j_ljets"]         -> fill(ht_lfjets/GeV);
+          _h_geq4b_geq6j_ljets.ht_bjets             -> fill(ht_bjets/GeV);
+          _h_geq4b_geq6j_ljets.ht_lfjets            -> fill(ht_lfjets/GeV);
           // b-jet pTs
-          _h["lead_bjet_pt_geq4b_geq6j_ljets"]      -> fill(bjets[0].pT()/GeV);
-          _h["sublead_bjet_pt_geq4b_geq6j_ljets"]   -> fill(bjets[1].pT()/GeV);
-          _h["third_bjet_pt_geq4b_geq6j_ljets"]     -> fill(bjets[2].pT()/GeV);              
-          _h["fourth_bjet_pt_geq4b_geq6j_ljets"]    -> fill(bjets[3].pT()/GeV);
+          _h_geq4b_geq6j_ljets.lead_bjet_pt         -> fill(bjets[0].pT()/GeV);
+          _h_geq4b_geq6j_ljets.sublead_bjet_pt      -> fill(bjets[1].pT()/GeV);
+          _h_geq4b_geq6j_ljets.third_bjet_pt        -> fill(bjets[2].pT()/GeV);              
+          _h_geq4b_geq6j_ljets.fourth_bjet_pt       -> fill(bjets[3].pT()/GeV);
 
           // HT
-          _h["ht_geq4b_geq6j_ljets"]                -> fill(ht/GeV);
-          _h["ht_had_geq4b_geq6j_ljets"]            -> fill(hthad/GeV);
+          _h_geq4b_geq6j_ljets.ht                   -> fill(ht/GeV);
+          _h_geq4b_geq6j_ljets.ht_had               -> fill(hthad/GeV);
 
           // leading bb pair
-          _h["m_bb_leading_geq4b_geq6j_ljets"]      -> fill(jsum.mass()/GeV);
-          _h["pt_bb_leading_geq4b_geq6j_ljets"]     -> fill(jsum.pT()/GeV);
-          _h["dR_bb_leading_geq4b_geq6j_ljets"]     -> fill(dr_leading);
+          _h_geq4b_geq6j_ljets.m_bb_leading         -> fill(jsum.mass()/GeV);
+          _h_geq4b_geq6j_ljets.pt_bb_leading        -> fill(jsum.pT()/GeV);
+          _h_geq4b_geq6j_ljets.dR_bb_leading        -> fill(dr_leading);
 
           // closest bb pair
-          _h["m_bb_closest_geq4b_geq6j_ljets"]      -> fill(bb_closest.mass()/GeV);
-          _h["pt_bb_closest_geq4b_geq6j_ljets"]     -> fill(bb_closest.pT()/GeV);
-          _h["dR_bb_closest_geq4b_geq6j_ljets"]     -> fill(dr_closest);
+          _h_geq4b_geq6j_ljets.m_bb_closest         -> fill(bb_closest.mass()/GeV);
+          _h_geq4b_geq6j_ljets.pt_bb_closest        -> fill(bb_closest.pT()/GeV);
+          _h_geq4b_geq6j_ljets.dR_bb_closest        -> fill(dr_closest);
 
           // bb pair with highest vectorial sum pt                                                                                                                                                        
-          _h["m_bb_leadingVec_geq4b_geq6j_ljets"]   -> fill(m_leading_vec/GeV);
-          _h["pt_bb_leadingVec_geq4b_geq6j_ljets"]  -> fill(pt_leading_vec/GeV);
-          _h["dR_bb_leadingVec_geq4b_geq6j_ljets"]  -> fill(dr_leading_vec);
+          _h_geq4b_geq6j_ljets.m_bb_leadingVec      -> fill(m_leading_vec/GeV);
+          _h_geq4b_geq6j_ljets.pt_bb_leadingVec     -> fill(pt_leading_vec/GeV);
+          _h_geq4b_geq6j_ljets.dR_bb_leadingVec     -> fill(dr_leading_vec);
 
 
           // average dR
-          _h["dR_bb_average_geq4b_geq6j_ljets"]     -> fill(sum_dr/sum_n_dr);
+          _h_geq4b_geq6j_ljets.dR_bb_average        -> fill(sum_dr/sum_n_dr);
 
-          _h["fid_xsec_geq4b_geq6j_ljets"]          -> fill(event.weights()[0]);
+          _h_geq4b_geq6j_ljets.fid_xsec             -> fill(event.weights()[0]);
           // _h["abs_weight_1000_geq4b_geq6j_ljets"] -> fill(event.weights()[0]);
           // _h["abs_weight_100_geq4b_geq6j_ljets"]  -> fill(event.weights()[0]);
           // _h["abs_weight_5_geq4b_geq6j_ljets"]    -> fill(event.weights()[0]);
@@ -531,44 +539,44 @@ namespace Rivet {
       // dil
       // lets do the 3bjets geq4njets category first                                                                                                                                             
       if (pass_dil && (nbjets == 3 && njets >= 4)) {
-        _h["N_Jets_3b_geq4j_dil"]               -> fill(njets);
-        _h["N_b_Jets_3b_geq4j_dil"]             -> fill(nbjets);
+        _h_3b_geq4j_dil.N_Jets                  -> fill(njets);
+        _h_3b_geq4j_dil.N_b_Jets                -> fill(nbjets);
         for (size_t i = 0; i < bjets.size(); ++i) {
-          _h["all_bjets_pt_3b_geq4j_dil"]     -> fill(bjets[i].pT()/GeV);
+          _h_3b_geq4j_dil.all_bjets_pt        -> fill(bjets[i].pT()/GeV);
         }
         for (size_t i = 0; i < lfjets.size(); ++i) {
-          _h["all_lfjets_pt_3b_geq4j_dil"]    -> fill(lfjets[i].pT()/GeV);
+          _h_3b_geq4j_dil.all_lfjets_pt       -> fill(lfjets[i].pT()/GeV);
         }
-        _h["ht_bjets_3b_geq4j_dil"]             -> fill(ht_bjets/GeV);
-        _h["ht_lfjets_3b_geq4j_dil"]            -> fill(ht_lfjets/GeV);
+        _h_3b_geq4j_dil.ht_bjets                -> fill(ht_bjets/GeV);
+        _h_3b_geq4j_dil.ht_lfjets               -> fill(ht_lfjets/GeV);
         // b-jet pTs                                                                                                                                                                                     
-        _h["lead_bjet_pt_3b_geq4j_dil"]         -> fill(bjets[0].pT()/GeV);
-        _h["sublead_bjet_pt_3b_geq4j_dil"]      -> fill(bjets[1].pT()/GeV);
-        _h["third_bjet_pt_3b_geq4j_dil"]        -> fill(bjets[2].pT()/GeV);
+        _h_3b_geq4j_dil.lead_bjet_pt            -> fill(bjets[0].pT()/GeV);
+        _h_3b_geq4j_dil.sublead_bjet_pt         -> fill(bjets[1].pT()/GeV);
+        _h_3b_geq4j_dil.third_bjet_pt           -> fill(bjets[2].pT()/GeV);
 
         // HT                                                                                                                                                                                             
-        _h["ht_3b_geq4j_dil"]                   -> fill(ht/GeV);
-        _h["ht_had_3b_geq4j_dil"]               -> fill(hthad/GeV);
+        _h_3b_geq4j_dil.ht                      -> fill(ht/GeV);
+        _h_3b_geq4j_dil.ht_had                  -> fill(hthad/GeV);
 
         // leading bb pair                                                                                                                                                                               
-        _h["m_bb_leading_3b_geq4j_dil"]         -> fill(jsum.mass()/GeV);
-        _h["pt_bb_leading_3b_geq4j_dil"]        -> fill(jsum.pT()/GeV);
-        _h["dR_bb_leading_3b_geq4j_dil"]        -> fill(dr_leading);
+        _h_3b_geq4j_dil.m_bb_leading            -> fill(jsum.mass()/GeV);
+        _h_3b_geq4j_dil.pt_bb_leading           -> fill(jsum.pT()/GeV);
+        _h_3b_geq4j_dil.dR_bb_leading           -> fill(dr_leading);
 
         // closest bb pair                                                                                                                                                                                
-        _h["m_bb_closest_3b_geq4j_dil"]         -> fill(bb_closest.mass()/GeV);
-        _h["pt_bb_closest_3b_geq4j_dil"]        -> fill(bb_closest.pT()/GeV);
-        _h["dR_bb_closest_3b_geq4j_dil"]        -> fill(dr_closest);
+        _h_3b_geq4j_dil.m_bb_closest            -> fill(bb_closest.mass()/GeV);
+        _h_3b_geq4j_dil.pt_bb_closest           -> fill(bb_closest.pT()/GeV);
+        _h_3b_geq4j_dil.dR_bb_closest           -> fill(dr_closest);
 
         // bb pair with highest vectorial sum pt                                                                                                                                                          
-        _h["m_bb_leadingVec_3b_geq4j_dil"]         -> fill(m_leading_vec/GeV);
-        _h["pt_bb_leadingVec_3b_geq4j_dil"]        -> fill(pt_leading_vec/GeV);
-        _h["dR_bb_leadingVec_3b_geq4j_dil"]        -> fill(dr_leading_vec);
+        _h_3b_geq4j_dil.m_bb_leadingVec            -> fill(m_leading_vec/GeV);
+        _h_3b_geq4j_dil.pt_bb_leadingVec           -> fill(pt_leading_vec/GeV);
+        _h_3b_geq4j_dil.dR_bb_leadingVec           -> fill(dr_leading_vec);
 
         // average dR                                                                                                                                                                                     
-        _h["dR_bb_average_3b_geq4j_dil"]        -> fill(sum_dr/sum_n_dr);
+        _h_3b_geq4j_dil.dR_bb_average           -> fill(sum_dr/sum_n_dr);
 
-        _h["fid_xsec_3b_geq4j_dil"]           -> fill(event.weights()[0]);
+        _h_3b_geq4j_dil.fid_xsec              -> fill(event.weights()[0]);
         // _h["abs_weight_1000_3b_geq4j_dil"] -> fill(event.weights()[0]);
         // _h["abs_weight_100_3b_geq4j_dil"]  -> fill(event.weights()[0]);
         // _h["abs_weight_5_3b_geq4j_dil"]    -> fill(event.weights()[0]);
@@ -577,46 +585,46 @@ namespace Rivet {
 
       // lets do the geq4bjets geq4njets category now                                                                                                                                                     
       if (pass_dil && (nbjets >= 4 && njets >= 4)) {
-        _h["N_Jets_geq4b_geq4j_dil"]            -> fill(njets);
-        _h["N_b_Jets_geq4b_geq4j_dil"]          -> fill(nbjets);
+        _h_geq4b_geq4j_dil.N_Jets               -> fill(njets);
+        _h_geq4b_geq4j_dil.N_b_Jets             -> fill(nbjets);
         for (size_t i = 0; i < bjets.size(); ++i) {
-          _h["all_bjets_pt_geq4b_geq4j_dil"]  -> fill(bjets[i].pT()/GeV);
+          _h_geq4b_geq4j_dil.all_bjets_pt     -> fill(bjets[i].pT()/GeV);
         }
         for (size_t i = 0; i < lfjets.size(); ++i) {
-          _h["all_lfjets_pt_geq4b_geq4j_dil"] -> fill(lfjets[i].pT()/GeV);
+          _h_geq4b_geq4j_dil.all_lfjets_pt    -> fill(lfjets[i].pT()/GeV);
         }
-        _h["ht_bjets_geq4b_geq4j_dil"]          -> fill(ht_bjets/GeV);
-        _h["ht_lfjets_geq4b_geq4j_dil"]         -> fill(ht_lfjets/GeV);
+        _h_geq4b_geq4j_dil.ht_bjets             -> fill(ht_bjets/GeV);
+        _h_geq4b_geq4j_dil.ht_lfjets            -> fill(ht_lfjets/GeV);
         // b-jet pTs                                                                                                                                                                                      
-        _h["lead_bjet_pt_geq4b_geq4j_dil"]      -> fill(bjets[0].pT()/GeV);
-        _h["sublead_bjet_pt_geq4b_geq4j_dil"]   -> fill(bjets[1].pT()/GeV);
-        _h["third_bjet_pt_geq4b_geq4j_dil"]     -> fill(bjets[2].pT()/GeV);
-        _h["fourth_bjet_pt_geq4b_geq4j_dil"]    -> fill(bjets[3].pT()/GeV);
+        _h_geq4b_geq4j_dil.lead_bjet_pt         -> fill(bjets[0].pT()/GeV);
+        _h_geq4b_geq4j_dil.sublead_bjet_pt      -> fill(bjets[1].pT()/GeV);
+        _h_geq4b_geq4j_dil.third_bjet_pt        -> fill(bjets[2].pT()/GeV);
+        _h_geq4b_geq4j_dil.fourth_bjet_pt       -> fill(bjets[3].pT()/GeV);
 
         // HT                                                                                                                                                                                             
-        _h["ht_geq4b_geq4j_dil"]                -> fill(ht/GeV);
-        _h["ht_had_geq4b_geq4j_dil"]            -> fill(hthad/GeV);
+        _h_geq4b_geq4j_dil.ht                   -> fill(ht/GeV);
+        _h_geq4b_geq4j_dil.ht_had               -> fill(hthad/GeV);
 
         // leading bb pair                                                                                                                                                                                
-        _h["m_bb_leading_geq4b_geq4j_dil"]      -> fill(jsum.mass()/GeV);
-        _h["pt_bb_leading_geq4b_geq4j_dil"]     -> fill(jsum.pT()/GeV);
-        _h["dR_bb_leading_geq4b_geq4j_dil"]     -> fill(dr_leading);
+        _h_geq4b_geq4j_dil.m_bb_leading         -> fill(jsum.mass()/GeV);
+        _h_geq4b_geq4j_dil.pt_bb_leading        -> fill(jsum.pT()/GeV);
+        _h_geq4b_geq4j_dil.dR_bb_leading        -> fill(dr_leading);
 
         // closest bb pair                                                                                                                                                                                
-        _h["m_bb_closest_geq4b_geq4j_dil"]      -> fill(bb_closest.mass()/GeV);
-        _h["pt_bb_closest_geq4b_geq4j_dil"]     -> fill(bb_closest.pT()/GeV);
-        _h["dR_bb_closest_geq4b_geq4j_dil"]     -> fill(dr_closest);
+        _h_geq4b_geq4j_dil.m_bb_closest         -> fill(bb_closest.mass()/GeV);
+        _h_geq4b_geq4j_dil.pt_bb_closest        -> fill(bb_closest.pT()/GeV);
+        _h_geq4b_geq4j_dil.dR_bb_closest        -> fill(dr_closest);
 
         // bb pair with highest vectorial sum pt                                                                                                                                                          
-        _h["m_bb_leadingVec_geq4b_geq4j_dil"]   -> fill(m_leading_vec/GeV);
-        _h["pt_bb_leadingVec_geq4b_geq4j_dil"]  -> fill(pt_leading_vec/GeV);
-        _h["dR_bb_leadingVec_geq4b_geq4j_dil"]  -> fill(dr_leading_vec);
+        _h_geq4b_geq4j_dil.m_bb_leadingVec      -> fill(m_leading_vec/GeV);
+        _h_geq4b_geq4j_dil.pt_bb_leadingVec     -> fill(pt_leading_vec/GeV);
+        _h_geq4b_geq4j_dil.dR_bb_leadingVec     -> fill(dr_leading_vec);
 
 
         // average dR                                                                                                                                                                                     
-        _h["dR_bb_average_geq4b_geq4j_dil"]     -> fill(sum_dr/sum_n_dr);
+        _h_geq4b_geq4j_dil.dR_bb_average        -> fill(sum_dr/sum_n_dr);
 
-        _h["fid_xsec_geq4b_geq4j_dil"]          -> fill(event.weights()[0]);
+        _h_geq4b_geq4j_dil.fid_xsec             -> fill(event.weights()[0]);
         // _h["abs_weight_1000_geq4b_geq4j_dil"] -> fill(event.weights()[0]);
         // _h["abs_weight_100_geq4b_geq4j_dil"]  -> fill(event.weights()[0]);
         // _h["abs_weight_5_geq4b_geq4j_dil"]    -> fill(event.weights()[0]);
@@ -649,6 +657,66 @@ namespace Rivet {
     map<string, Histo1DPtr> _h;
     // map<string, Profile1DPtr> _p;
     // map<string, CounterPtr> _c;
+
+    /// Fill handles for the histograms of one selection category
+    struct CategoryHistos {
+      Histo1DPtr N_Jets;
+      Histo1DPtr N_b_Jets;
+      Histo1DPtr all_bjets_pt;
+      Histo1DPtr all_lfjets_pt;
+      Histo1DPtr ht_bjets;
+      Histo1DPtr ht_lfjets;
+      Histo1DPtr ht;
+      Histo1DPtr ht_had;
+      Histo1DPtr lead_bjet_pt;
+      Histo1DPtr sublead_bjet_pt;
+      Histo1DPtr third_bjet_pt;
+      Histo1DPtr fourth_bjet_pt;
+      Histo1DPtr m_bb_leading;
+      Histo1DPtr pt_bb_leading;
+      Histo1DPtr dR_bb_leading;
+      Histo1DPtr m_bb_closest;
+      Histo1DPtr pt_bb_closest;
+      Histo1DPtr dR_bb_closest;
+      Histo1DPtr dR_bb_average;
+      Histo1DPtr m_bb_leadingVec;
+      Histo1DPtr pt_bb_leadingVec;
+      Histo1DPtr dR_bb_leadingVec;
+      Histo1DPtr fid_xsec;
+    };
+
+    /// Look up the histograms booked for the category with name suffix @a cat
+    CategoryHistos categoryHistos(const string& cat) {
+      CategoryHistos c;
+      c.N_Jets           = _h.at("N_Jets_" + cat);
+      c.N_b_Jets         = _h.at("N_b_Jets_" + cat);
+      c.all_bjets_pt     = _h.at("all_bjets_pt_" + cat);
+      c.all_lfjets_pt    = _h.at("all_lfjets_pt_" + cat);
+      c.ht_bjets         = _h.at("ht_bjets_" + cat);
+      c.ht_lfjets        = _h.at("ht_lfjets_" + cat);
+      c.ht               = _h.at("ht_" + cat);
+      c.ht_had           = _h.at("ht_had_" + cat);
+      c.lead_bjet_pt     = _h.at("lead_bjet_pt_" + cat);
+      c.sublead_bjet_pt  = _h.at("sublead_bjet_pt_" + cat);
+      c.third_bjet_pt    = _h.at("third_bjet_pt_" + cat);
+      c.fourth_bjet_pt   = _h.at("fourth_bjet_pt_" + cat);
+      c.m_bb_leading     = _h.at("m_bb_leading_" + cat);
+      c.pt_bb_leading    = _h.at("pt_bb_leading_" + cat);
+      c.dR_bb_leading    = _h.at("dR_bb_leading_" + cat);
+      c.m_bb_closest     = _h.at("m_bb_closest_" + cat);
+      c.pt_bb_closest    = _h.at("pt_bb_closest_" + cat);
+      c.dR_bb_closest    = _h.at("dR_bb_closest_" + cat);
+      c.dR_bb_average    = _h.at("dR_bb_average_" + cat);
+      c.m_bb_leadingVec  = _h.at("m_bb_leadingVec_" + cat);
+      c.pt_bb_leadingVec = _h.at("pt_bb_leadingVec_" + cat);
+      c.dR_bb_leadingVec = _h.at("dR_bb_leadingVec_" + cat);
+      c.fid_xsec         = _h.at("fid_xsec_" + cat);
+      return c;
+    }
+
+    CategoryHistos _h_3b_geq5j_ljets, _h_geq4b_geq5j_ljets, _h_geq4b_geq6j_ljets;
+    CategoryHistos _h_3b_geq4j_dil, _h_geq4b_geq4j_dil;
+    Histo1DPtr _h_fid_xsec_geq1lep;
     //@}
 
 